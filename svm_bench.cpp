@@ -0,0 +1,595 @@
+//
+//  svm_bench.cpp
+//
+//  Timing benchmarks for the mothur svm code.
+//
+//  Build and run with:
+//      make svm_bench
+//      ./svm_bench
+//
+//  Options are given as name=value pairs:
+//      n=300 d=200 density=0.2     size of the synthetic SmoTrainer dataset;
+//                                  n >= 2, d >= 1 and 0 < density <= 1
+//      repeat=3                    runs per micro-benchmark, the fastest is
+//                                  kept; at least 1
+//      shared=x design=y           files for the parsing benchmark
+//                                  (default iris.shared and iris.design)
+//      json=svm_bench.json         where to write the results as JSON
+//
+//  For example, to measure parsing of the HMP stool data:
+//      ./svm_bench shared=Stool.0.03.subsample.0.03.filter.shared design=Stool.0.03.subsample.0.03.filter.mix.design
+//
+//  The kernel benchmarks use synthetic data shaped like the iris
+//  dataset (150 observations, 4 features) and like the HMP stool
+//  dataset (596 observations, thousands of mostly-zero OTU features).
+//  The iris benchmarks need iris.shared and iris.design in the current
+//  directory.
+//
+//  Times come from CLOCK_MONOTONIC.  Each kernel benchmark runs enough
+//  passes over the n x n matrix to fill at least 10 ms, and reports the
+//  time per pass.
+//
+//  Each benchmark also reports how many calls to operator new, and how
+//  many bytes, the timed code made.  For repeated benchmarks these come
+//  from the fastest run, the same run the reported time comes from.
+//
+
+#include <sys/stat.h>
+#include <time.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "mothur/mothurout.h"
+#include "mothur/classifysvmsharedcommand.h"
+#include "mothur/svm.hpp"
+
+
+MothurOut* MothurOut::_uniqueInstance = 0;
+
+
+// Replace the global operator new and delete so every heap allocation
+// made by the mothur code and the standard library is counted.  The
+// benchmarks are single threaded so the counters are not atomic.
+// noinline keeps gcc from seeing malloc() and free() inside operator
+// new and delete and warning about mismatched allocation functions.
+static unsigned long long totalAllocationCount = 0;
+static unsigned long long totalAllocatedByteCount = 0;
+
+__attribute__((noinline)) void* operator new(std::size_t size) {
+    totalAllocationCount++;
+    totalAllocatedByteCount += size;
+    void* p = malloc(size == 0 ? 1 : size);
+    if ( p == NULL ) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+__attribute__((noinline)) void operator delete(void* p) noexcept {
+    free(p);
+}
+
+__attribute__((noinline)) void operator delete(void* p, std::size_t) noexcept {
+    free(p);
+}
+
+// Counts allocations made between construction and a call to one of
+// the get methods.
+class AllocationCounter {
+public:
+    AllocationCounter() : startAllocationCount(totalAllocationCount), startAllocatedByteCount(totalAllocatedByteCount) {}
+
+    unsigned long long getAllocationCount() const { return totalAllocationCount - startAllocationCount; }
+    unsigned long long getAllocatedByteCount() const { return totalAllocatedByteCount - startAllocatedByteCount; }
+
+private:
+    const unsigned long long startAllocationCount;
+    const unsigned long long startAllocatedByteCount;
+};
+
+
+// One line of benchmark output.  Fields that do not apply to a benchmark
+// are left empty or zero and are not written to the JSON file.
+class BenchmarkResult {
+public:
+    BenchmarkResult(const std::string& _benchmark, const std::string& _dataset) :
+        benchmark(_benchmark), dataset(_dataset), n(0), d(0), density(0.0), seconds(0.0), operationCount(0.0),
+        passCount(1), allocationCount(0), allocatedByteCount(0) {}
+
+    void setAllocations(const AllocationCounter& allocationCounter) {
+        allocationCount = allocationCounter.getAllocationCount();
+        allocatedByteCount = allocationCounter.getAllocatedByteCount();
+    }
+
+    std::string benchmark;
+    std::string dataset;
+    std::string kernel;
+    int n;
+    int d;
+    double density;
+    double seconds;
+    // kernel evaluations for the kernel benchmarks, MB for the parsing benchmark
+    double operationCount;
+    std::string operationUnit;
+    // passes in the timed region; seconds and allocations are per pass
+    int passCount;
+    unsigned long long allocationCount;
+    unsigned long long allocatedByteCount;
+};
+
+typedef std::vector<BenchmarkResult> BenchmarkResultVector;
+
+
+// The kernel benchmarks repeat the n x n fill until each timed region
+// lasts at least this long, so that small inputs such as iris are not
+// dominated by timer resolution.
+const double minimumTimedSeconds = 0.01;
+
+// Seconds from a clock that is not affected by changes to the system
+// time, unlike gettimeofday().
+double getMonotonicSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1.0e-9;
+}
+
+// Parse options[name] as an int.  The whole value must be a number in
+// range, so "1e5" or "3x" are rejected rather than read as 1 or 3.
+bool parseIntOption(std::map<std::string, std::string>& options, const std::string& name, int& result) {
+    const std::string& value = options[name];
+    char* end = NULL;
+    errno = 0;
+    const long parsed = strtol(value.c_str(), &end, 10);
+    if ( value.empty() || *end != '\0' || errno != 0 || parsed < INT_MIN || parsed > INT_MAX ) {
+        std::cout << "invalid value for " << name << ": " << value << std::endl;
+        return false;
+    }
+    result = parsed;
+    return true;
+}
+
+// Parse options[name] as a finite double.  The whole value must be a
+// number, so "0.5x" is rejected rather than read as 0.5.
+bool parseDoubleOption(std::map<std::string, std::string>& options, const std::string& name, double& result) {
+    const std::string& value = options[name];
+    char* end = NULL;
+    errno = 0;
+    const double parsed = strtod(value.c_str(), &end);
+    if ( value.empty() || *end != '\0' || errno != 0 || !std::isfinite(parsed) ) {
+        std::cout << "invalid value for " << name << ": " << value << std::endl;
+        return false;
+    }
+    result = parsed;
+    return true;
+}
+
+std::string toJsonString(const std::string& s) {
+    std::string json = "\"";
+    for (std::string::const_iterator c = s.begin(); c != s.end(); c++) {
+        if ( *c == '"' || *c == '\\' ) {
+            json += '\\';
+        }
+        json += *c;
+    }
+    return json + "\"";
+}
+
+void writeJson(const BenchmarkResultVector& results, std::ostream& out) {
+    out << std::setprecision(9);
+    out << "[" << std::endl;
+    for (BenchmarkResultVector::size_type i = 0; i < results.size(); i++) {
+        const BenchmarkResult& r = results[i];
+        out << "  {\"benchmark\": " << toJsonString(r.benchmark)
+            << ", \"dataset\": " << toJsonString(r.dataset);
+        if ( !r.kernel.empty() ) {
+            out << ", \"kernel\": " << toJsonString(r.kernel);
+        }
+        if ( r.n > 0 ) {
+            out << ", \"n\": " << r.n << ", \"d\": " << r.d << ", \"density\": " << r.density;
+        }
+        out << ", \"seconds\": " << r.seconds << ", \"passes\": " << r.passCount;
+        if ( !r.operationUnit.empty() ) {
+            out << ", " << toJsonString(r.operationUnit) << ": " << r.operationCount;
+        }
+        out << ", \"allocations\": " << r.allocationCount << ", \"allocated_bytes\": " << r.allocatedByteCount;
+        out << "}" << (i + 1 < results.size() ? "," : "") << std::endl;
+    }
+    out << "]" << std::endl;
+}
+
+// Fill observations with n random observations of d features and label
+// them round-robin with labelCount labels.  Each feature is non-zero with
+// probability density.  Features j with j % labelCount equal to the
+// label number are shifted up by 0.5 so the classes are separable enough
+// for SmoTrainer to converge.  The observations vector owns the data so
+// it must outlive labeledObservationVector.
+void buildSyntheticDataset(int n, int d, double density, int labelCount, unsigned int seed,
+                           std::vector<Observation>& observations,
+                           LabeledObservationVector& labeledObservationVector) {
+    srand(seed);
+    observations.assign(n, Observation(d, 0.0));
+    labeledObservationVector.clear();
+    for (int i = 0; i < n; i++) {
+        const int labelNumber = i % labelCount;
+        for (int j = 0; j < d; j++) {
+            if ( (double) rand() / RAND_MAX < density ) {
+                observations[i][j] = (double) rand() / RAND_MAX + (j % labelCount == labelNumber ? 0.5 : 0.0);
+            }
+        }
+        std::ostringstream label;
+        label << "class_" << labelNumber;
+        labeledObservationVector.push_back(LabeledObservation(i, label.str(), &observations[i]));
+    }
+}
+
+void deleteObservations(LabeledObservationVector& labeledObservationVector) {
+    for (LabeledObservationVector::iterator i = labeledObservationVector.begin(); i != labeledObservationVector.end(); i++) {
+        delete i->second;
+    }
+}
+
+void printResult(const BenchmarkResult& r) {
+    std::cout << std::left << std::setw(12) << r.benchmark
+              << std::setw(12) << r.dataset
+              << std::setw(12) << r.kernel
+              << std::right << std::fixed << std::setprecision(6)
+              << std::setw(14) << r.seconds
+              << std::setw(14) << r.allocationCount;
+    if ( r.operationUnit == "evaluations" ) {
+        std::cout << std::setprecision(2) << std::setw(12) << 1.0e9 * r.seconds / r.operationCount << " ns/evaluation";
+    }
+    else if ( r.operationUnit == "megabytes" ) {
+        std::cout << std::setprecision(2) << std::setw(12) << r.operationCount / r.seconds << " MB/s";
+    }
+    std::cout << std::endl;
+}
+
+double sumParameterFreeSimilarities(KernelFunction& kernelFunction, LabeledObservationVector& X) {
+    double sum = 0.0;
+    for (LabeledObservationVector::size_type i = 0; i < X.size(); i++) {
+        for (LabeledObservationVector::size_type j = 0; j < X.size(); j++) {
+            sum += kernelFunction.calculateParameterFreeSimilarity(X[i], X[j]);
+        }
+    }
+    return sum;
+}
+
+double sumSimilarities(KernelFunction& kernelFunction, LabeledObservationVector& X) {
+    double sum = 0.0;
+    for (LabeledObservationVector::size_type i = 0; i < X.size(); i++) {
+        for (LabeledObservationVector::size_type j = 0; j < X.size(); j++) {
+            sum += kernelFunction.similarity(X[i], X[j]);
+        }
+    }
+    return sum;
+}
+
+double sumCachedSimilarities(KernelFunction& kernelFunction, LabeledObservationVector& X) {
+    KernelFunctionCache kernelFunctionCache(kernelFunction, X);
+    double sum = 0.0;
+    for (LabeledObservationVector::size_type i = 0; i < X.size(); i++) {
+        for (LabeledObservationVector::size_type j = 0; j < X.size(); j++) {
+            sum += kernelFunctionCache.similarity(X[i], X[j]);
+        }
+    }
+    return sum;
+}
+
+// Time three ways of filling the full n x n kernel matrix:
+//   primitive - calculateParameterFreeSimilarity() for every pair, i.e.
+//               the dot product or squared distance alone
+//   cold rows - similarity() on a freshly built kernel function, which
+//               computes and caches each row the first time it is touched
+//   cache     - similarity() through a freshly built KernelFunctionCache
+// Each timed region runs enough passes over the matrix to last at least
+// minimumTimedSeconds, using fresh kernel functions for every cold rows
+// and cache pass.  The kernel functions are built before the clock
+// starts.  The region is run repeatCount times and the fastest is kept;
+// seconds and allocations are reported per pass.  density is the value
+// X was built with and is only recorded in the results.
+void benchmarkKernel(const std::string& datasetName, const std::string& kernelKey,
+                     LabeledObservationVector& X, double density, int repeatCount, BenchmarkResultVector& results) {
+    const int n = X.size();
+    double checksum = 0.0;
+
+    BenchmarkResult primitive("primitive", datasetName);
+    BenchmarkResult coldRows("cold_rows", datasetName);
+    BenchmarkResult cacheFill("cache_fill", datasetName);
+    BenchmarkResult* kernelResults[] = {&primitive, &coldRows, &cacheFill};
+
+    KernelFunctionFactory primitiveFactory(X);
+    KernelFunction& primitiveKernelFunction = primitiveFactory.getKernelFunctionForKey(kernelKey);
+
+    // one pass of the primitive fill sets the number of passes per region
+    double start = getMonotonicSeconds();
+    checksum += sumParameterFreeSimilarities(primitiveKernelFunction, X);
+    const double onePassSeconds = std::max(getMonotonicSeconds() - start, 1.0e-9);
+    const int passCount = std::max(1, (int) std::ceil(minimumTimedSeconds / onePassSeconds));
+
+    for (int k = 0; k < 3; k++) {
+        for (int r = 0; r < repeatCount; r++) {
+            std::vector<KernelFunctionFactory*> factories;
+            std::vector<KernelFunction*> kernelFunctions;
+            if ( kernelResults[k] != &primitive ) {
+                for (int p = 0; p < passCount; p++) {
+                    factories.push_back(new KernelFunctionFactory(X));
+                    kernelFunctions.push_back(&factories.back()->getKernelFunctionForKey(kernelKey));
+                }
+            }
+
+            AllocationCounter allocationCounter;
+            start = getMonotonicSeconds();
+            for (int p = 0; p < passCount; p++) {
+                if ( kernelResults[k] == &primitive ) {
+                    checksum += sumParameterFreeSimilarities(primitiveKernelFunction, X);
+                }
+                else if ( kernelResults[k] == &coldRows ) {
+                    checksum += sumSimilarities(*kernelFunctions[p], X);
+                }
+                else {
+                    checksum += sumCachedSimilarities(*kernelFunctions[p], X);
+                }
+            }
+            double seconds = (getMonotonicSeconds() - start) / passCount;
+            if ( r == 0 || seconds < kernelResults[k]->seconds ) {
+                kernelResults[k]->seconds = seconds;
+                kernelResults[k]->allocationCount = allocationCounter.getAllocationCount() / passCount;
+                kernelResults[k]->allocatedByteCount = allocationCounter.getAllocatedByteCount() / passCount;
+            }
+
+            for (std::vector<KernelFunctionFactory*>::iterator f = factories.begin(); f != factories.end(); f++) {
+                delete *f;
+            }
+        }
+    }
+
+    for (int k = 0; k < 3; k++) {
+        kernelResults[k]->kernel = kernelKey;
+        kernelResults[k]->n = n;
+        kernelResults[k]->d = X[0].second->size();
+        kernelResults[k]->density = density;
+        kernelResults[k]->passCount = passCount;
+        kernelResults[k]->operationCount = (double) n * n;
+        kernelResults[k]->operationUnit = "evaluations";
+        printResult(*kernelResults[k]);
+        results.push_back(*kernelResults[k]);
+    }
+    // print the checksum so the compiler can not discard the kernel evaluations
+    std::cout << "    checksum " << std::scientific << checksum << std::endl;
+}
+
+void benchmarkKernels(const std::string& datasetName, LabeledObservationVector& X, double density, int repeatCount, BenchmarkResultVector& results) {
+    benchmarkKernel(datasetName, LinearKernelFunction::MapKey, X, density, repeatCount, results);
+    benchmarkKernel(datasetName, RbfKernelFunction::MapKey, X, density, repeatCount, results);
+    benchmarkKernel(datasetName, PolynomialKernelFunction::MapKey, X, density, repeatCount, results);
+    benchmarkKernel(datasetName, SigmoidKernelFunction::MapKey, X, density, repeatCount, results);
+}
+
+// Time SmoTrainer::train, including the KernelFunctionCache it trains
+// against, on a two-label synthetic dataset.
+void benchmarkSmoTrainer(int n, int d, double density, int repeatCount, BenchmarkResultVector& results) {
+    std::vector<Observation> observations;
+    LabeledObservationVector X;
+    buildSyntheticDataset(n, d, density, 2, 3, observations, X);
+
+    ExternalSvmTrainingInterruption externalInterruption;
+    OutputFilter outputFilter(OutputFilter::QUIET);
+
+    std::string kernelKeys[] = {LinearKernelFunction::MapKey, RbfKernelFunction::MapKey};
+    for (int k = 0; k < 2; k++) {
+        BenchmarkResult result("smo_train", "synthetic");
+        result.kernel = kernelKeys[k];
+        result.n = n;
+        result.d = d;
+        result.density = density;
+        for (int r = 0; r < repeatCount; r++) {
+            KernelFunctionFactory kernelFunctionFactory(X);
+            KernelFunction& kernelFunction = kernelFunctionFactory.getKernelFunctionForKey(kernelKeys[k]);
+            AllocationCounter allocationCounter;
+            double start = getMonotonicSeconds();
+            KernelFunctionCache kernelFunctionCache(kernelFunction, X);
+            SmoTrainer t(externalInterruption, outputFilter);
+            SVM* svm = t.train(kernelFunctionCache, X);
+            double seconds = getMonotonicSeconds() - start;
+            if ( r == 0 || seconds < result.seconds ) {
+                result.seconds = seconds;
+                result.setAllocations(allocationCounter);
+            }
+            delete svm;
+        }
+        printResult(result);
+        results.push_back(result);
+    }
+}
+
+// Time a full OneVsOneMultiClassSvmTrainer::train with the default kernel
+// parameter ranges, then SvmRfe::getOrderedFeatureList, on iris.  Each
+// gets its own copy of the data, as in svm_iris_test.
+void benchmarkIris(BenchmarkResultVector& results) {
+    ExternalSvmTrainingInterruption externalInterruption;
+    OutputFilter outputFilter(OutputFilter::QUIET);
+    int evaluationFoldCount = 3;
+    int trainFoldCount = 5;
+
+    {
+        ClassifySvmSharedCommand classifySvmSharedCommand;
+        LabeledObservationVector labeledObservationVector;
+        FeatureVector featureVector;
+        classifySvmSharedCommand.readSharedAndDesignFiles("iris.shared", "iris.design", labeledObservationVector, featureVector);
+        SvmDataset svmDataset(labeledObservationVector, featureVector);
+        OneVsOneMultiClassSvmTrainer trainer(svmDataset, evaluationFoldCount, trainFoldCount, externalInterruption, outputFilter);
+
+        KernelParameterRangeMap kernelParameterRangeMap;
+        getDefaultKernelParameterRangeMap(kernelParameterRangeMap);
+
+        BenchmarkResult result("multiclass", "iris");
+        AllocationCounter allocationCounter;
+        double start = getMonotonicSeconds();
+        MultiClassSVM* s = trainer.train(kernelParameterRangeMap);
+        result.seconds = getMonotonicSeconds() - start;
+        result.setAllocations(allocationCounter);
+        delete s;
+        printResult(result);
+        results.push_back(result);
+        deleteObservations(labeledObservationVector);
+    }
+
+    {
+        ClassifySvmSharedCommand classifySvmSharedCommand;
+        LabeledObservationVector labeledObservationVector;
+        FeatureVector featureVector;
+        classifySvmSharedCommand.readSharedAndDesignFiles("iris.shared", "iris.design", labeledObservationVector, featureVector);
+        SvmDataset svmDataset(labeledObservationVector, featureVector);
+        OneVsOneMultiClassSvmTrainer trainer(svmDataset, evaluationFoldCount, trainFoldCount, externalInterruption, outputFilter);
+
+        BenchmarkResult result("svm_rfe", "iris");
+        result.kernel = LinearKernelFunction::MapKey;
+        SvmRfe svmRfe;
+        AllocationCounter allocationCounter;
+        double start = getMonotonicSeconds();
+        RankedFeatureList orderedFeatureList = svmRfe.getOrderedFeatureList(svmDataset, trainer, LinearKernelFunction::defaultConstantRange, SmoTrainer::defaultCRange);
+        result.seconds = getMonotonicSeconds() - start;
+        result.setAllocations(allocationCounter);
+        printResult(result);
+        results.push_back(result);
+        deleteObservations(labeledObservationVector);
+    }
+}
+
+// Time ClassifySvmSharedCommand::readSharedAndDesignFiles and report the
+// parse throughput in MB of shared file per second.  The density recorded
+// is the fraction of non-zero values in the parsed observations.
+void benchmarkReadSharedAndDesignFiles(const std::string& sharedFilePath, const std::string& designFilePath, BenchmarkResultVector& results) {
+    struct stat sharedFileStat;
+    if ( stat(sharedFilePath.c_str(), &sharedFileStat) != 0 ) {
+        std::cout << "unable to read " << sharedFilePath << std::endl;
+        return;
+    }
+
+    ClassifySvmSharedCommand classifySvmSharedCommand;
+    LabeledObservationVector labeledObservationVector;
+    FeatureVector featureVector;
+
+    BenchmarkResult result("read_shared", sharedFilePath);
+    AllocationCounter allocationCounter;
+    double start = getMonotonicSeconds();
+    classifySvmSharedCommand.readSharedAndDesignFiles(sharedFilePath, designFilePath, labeledObservationVector, featureVector);
+    result.seconds = getMonotonicSeconds() - start;
+    result.setAllocations(allocationCounter);
+    result.n = labeledObservationVector.size();
+    result.d = featureVector.size();
+    double nonZeroCount = 0.0;
+    for (LabeledObservationVector::iterator i = labeledObservationVector.begin(); i != labeledObservationVector.end(); i++) {
+        for (Observation::iterator j = i->second->begin(); j != i->second->end(); j++) {
+            if ( *j != 0.0 ) nonZeroCount++;
+        }
+    }
+    if ( result.n > 0 && result.d > 0 ) {
+        result.density = nonZeroCount / ((double) result.n * result.d);
+    }
+    result.operationCount = sharedFileStat.st_size / (1024.0 * 1024.0);
+    result.operationUnit = "megabytes";
+    printResult(result);
+    results.push_back(result);
+
+    deleteObservations(labeledObservationVector);
+}
+
+
+int main(int argc, char* argv[]) {
+    std::map<std::string, std::string> options;
+    options["n"] = "300";
+    options["d"] = "200";
+    options["density"] = "0.2";
+    options["repeat"] = "3";
+    options["shared"] = "iris.shared";
+    options["design"] = "iris.design";
+    options["json"] = "svm_bench.json";
+    const std::string usage = std::string("usage: ") + argv[0] +
+        " [n=N] [d=D] [density=F] [repeat=R] [shared=FILE design=FILE] [json=FILE]";
+    for (int i = 1; i < argc; i++) {
+        std::string argument = argv[i];
+        std::string::size_type equals = argument.find('=');
+        if ( equals == std::string::npos || options.find(argument.substr(0, equals)) == options.end() ) {
+            std::cout << "unknown option " << argument << std::endl;
+            std::cout << usage << std::endl;
+            return 1;
+        }
+        options[argument.substr(0, equals)] = argument.substr(equals + 1);
+    }
+
+    int repeatCount = 0;
+    int smoN = 0;
+    int smoD = 0;
+    double smoDensity = 0.0;
+    if ( !parseIntOption(options, "repeat", repeatCount) ||
+         !parseIntOption(options, "n", smoN) ||
+         !parseIntOption(options, "d", smoD) ||
+         !parseDoubleOption(options, "density", smoDensity) ) {
+        std::cout << usage << std::endl;
+        return 1;
+    }
+    if ( repeatCount < 1 || smoN < 2 || smoD < 1 || smoDensity <= 0.0 || smoDensity > 1.0 ) {
+        std::cout << "invalid options: need repeat >= 1, n >= 2, d >= 1 and 0 < density <= 1" << std::endl;
+        std::cout << usage << std::endl;
+        return 1;
+    }
+
+    // open the JSON file first so a bad path fails before the benchmarks run
+    std::ofstream jsonFile(options["json"].c_str());
+    if ( !jsonFile ) {
+        std::cout << "unable to open " << options["json"] << " for writing" << std::endl;
+        return 1;
+    }
+
+    BenchmarkResultVector results;
+
+    std::cout << std::left << std::setw(12) << "benchmark"
+              << std::setw(12) << "data"
+              << std::setw(12) << "kernel"
+              << std::right << std::setw(14) << "seconds"
+              << std::setw(14) << "allocations"
+              << std::endl;
+
+    // iris: 150 x 4, dense
+    std::vector<Observation> irisObservations;
+    LabeledObservationVector irisX;
+    const double irisDensity = 1.0;
+    buildSyntheticDataset(150, 4, irisDensity, 3, 1, irisObservations, irisX);
+    benchmarkKernels("iris", irisX, irisDensity, repeatCount, results);
+
+    // HMP stool: 596 x 2048, roughly 10% non-zero
+    std::vector<Observation> hmpObservations;
+    LabeledObservationVector hmpX;
+    const double hmpDensity = 0.1;
+    buildSyntheticDataset(596, 2048, hmpDensity, 3, 2, hmpObservations, hmpX);
+    benchmarkKernels("hmp", hmpX, hmpDensity, repeatCount, results);
+
+    benchmarkSmoTrainer(smoN, smoD, smoDensity, repeatCount, results);
+
+    benchmarkIris(results);
+
+    benchmarkReadSharedAndDesignFiles(options["shared"], options["design"], results);
+
+    writeJson(results, jsonFile);
+    jsonFile.close();
+    if ( !jsonFile ) {
+        std::cout << "unable to write results to " << options["json"] << std::endl;
+        return 1;
+    }
+    std::cout << "results written to " << options["json"] << std::endl;
+
+    return 0;
+}
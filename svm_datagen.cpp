@@ -0,0 +1,200 @@
+//
+//  svm_datagen.cpp
+//
+//  Writes a synthetic mothur shared file and design file for scaling
+//  tests and benchmarks of the svm code.
+//
+//  Build and run with:
+//      make svm_datagen
+//      ./svm_datagen samples=10000 otus=2000 classes=3 prefix=synthetic
+//
+//  which writes synthetic.shared and synthetic.design.  Options are given
+//  as name=value pairs:
+//      samples=1000        number of samples (rows of the shared file)
+//      otus=1000           number of OTUs (columns of the shared file)
+//      classes=2           number of classes in the design file
+//      density=0.1         probability that an OTU is present in a sample;
+//                          absent OTUs are structural zeros
+//      meancount=20        median of the per-OTU mean count when present;
+//                          must not be more than the maximum count below
+//      dispersion=1.0      negative binomial shape; smaller is more skewed
+//      separation=1.0      standard deviation of the per-class log-fold
+//                          change of each OTU mean; 0 gives no class signal
+//      seed=1              random number generator seed
+//      label=0.03          value of the shared file label column
+//      prefix=synthetic    output files are prefix.shared and prefix.design
+//
+//  Samples are assigned to classes round-robin and named class_k.i, in
+//  the same style as the groups in iris.shared.
+//
+//  The mean of each count is clamped to 1e9, so no count is much larger
+//  than that.  Without the clamp a large separation or meancount can give
+//  means so large that the Poisson sampler never returns.
+//
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+// largest mean passed to the Poisson sampler, see the comment above
+const double maximumMeanCount = 1.0e9;
+
+// Parse options[name] as an int.  The whole value must be a number in
+// range, so "1e5" or "3x" are rejected rather than read as 1 or 3.
+bool parseIntOption(std::map<std::string, std::string>& options, const std::string& name, int& result) {
+    const std::string& value = options[name];
+    char* end = NULL;
+    errno = 0;
+    const long parsed = strtol(value.c_str(), &end, 10);
+    if ( value.empty() || *end != '\0' || errno != 0 || parsed < INT_MIN || parsed > INT_MAX ) {
+        std::cout << "invalid value for " << name << ": " << value << std::endl;
+        return false;
+    }
+    result = parsed;
+    return true;
+}
+
+// Parse options[name] as a finite double.  The whole value must be a
+// number, so "0.5x" is rejected rather than read as 0.5.
+bool parseDoubleOption(std::map<std::string, std::string>& options, const std::string& name, double& result) {
+    const std::string& value = options[name];
+    char* end = NULL;
+    errno = 0;
+    const double parsed = strtod(value.c_str(), &end);
+    if ( value.empty() || *end != '\0' || errno != 0 || !std::isfinite(parsed) ) {
+        std::cout << "invalid value for " << name << ": " << value << std::endl;
+        return false;
+    }
+    result = parsed;
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    std::map<std::string, std::string> options;
+    options["samples"] = "1000";
+    options["otus"] = "1000";
+    options["classes"] = "2";
+    options["density"] = "0.1";
+    options["meancount"] = "20";
+    options["dispersion"] = "1.0";
+    options["separation"] = "1.0";
+    options["seed"] = "1";
+    options["label"] = "0.03";
+    options["prefix"] = "synthetic";
+    const std::string usage = std::string("usage: ") + argv[0] +
+        " [samples=N] [otus=N] [classes=N] [density=F] [meancount=F] [dispersion=F] [separation=F] [seed=N] [label=S] [prefix=S]";
+    for (int i = 1; i < argc; i++) {
+        std::string argument = argv[i];
+        std::string::size_type equals = argument.find('=');
+        if ( equals == std::string::npos || options.find(argument.substr(0, equals)) == options.end() ) {
+            std::cout << "unknown option " << argument << std::endl;
+            std::cout << usage << std::endl;
+            return 1;
+        }
+        options[argument.substr(0, equals)] = argument.substr(equals + 1);
+    }
+
+    int sampleCount = 0;
+    int otuCount = 0;
+    int classCount = 0;
+    int seed = 0;
+    double density = 0.0;
+    double meanCount = 0.0;
+    double dispersion = 0.0;
+    double separation = 0.0;
+    if ( !parseIntOption(options, "samples", sampleCount) ||
+         !parseIntOption(options, "otus", otuCount) ||
+         !parseIntOption(options, "classes", classCount) ||
+         !parseIntOption(options, "seed", seed) ||
+         !parseDoubleOption(options, "density", density) ||
+         !parseDoubleOption(options, "meancount", meanCount) ||
+         !parseDoubleOption(options, "dispersion", dispersion) ||
+         !parseDoubleOption(options, "separation", separation) ) {
+        std::cout << usage << std::endl;
+        return 1;
+    }
+    if ( sampleCount < classCount || otuCount < 1 || classCount < 2 ||
+         density <= 0.0 || density > 1.0 || meanCount <= 0.0 || meanCount > maximumMeanCount || dispersion <= 0.0 || separation < 0.0 ) {
+        std::cout << "invalid options: need samples >= classes >= 2, otus >= 1, 0 < density <= 1, "
+                  << "0 < meancount <= " << maximumMeanCount << ", dispersion > 0 and separation >= 0" << std::endl;
+        std::cout << usage << std::endl;
+        return 1;
+    }
+
+    std::mt19937 generator(seed);
+
+    // each OTU gets a log-normal base mean and each class scales it by
+    // exp(separation * z) with z drawn from a standard normal
+    std::lognormal_distribution<double> baseMeanDistribution(std::log(meanCount), 1.0);
+    std::normal_distribution<double> classEffectDistribution(0.0, 1.0);
+    std::vector<std::vector<double> > classOtuMean(classCount, std::vector<double>(otuCount));
+    for (int j = 0; j < otuCount; j++) {
+        const double baseMean = baseMeanDistribution(generator);
+        for (int k = 0; k < classCount; k++) {
+            classOtuMean[k][j] = baseMean * std::exp(separation * classEffectDistribution(generator));
+        }
+    }
+
+    // zero-inflated negative binomial counts: an OTU is present with
+    // probability density, and a present OTU's count is a gamma-Poisson
+    // mixture with the class mean and the given dispersion
+    std::bernoulli_distribution presentDistribution(density);
+    std::gamma_distribution<double> rateDistribution(dispersion, 1.0 / dispersion);
+
+    std::string sharedFilePath = options["prefix"] + ".shared";
+    std::string designFilePath = options["prefix"] + ".design";
+    std::ofstream sharedFile(sharedFilePath.c_str());
+    std::ofstream designFile(designFilePath.c_str());
+    if ( !sharedFile || !designFile ) {
+        std::cout << "unable to open " << sharedFilePath << " or " << designFilePath << " for writing" << std::endl;
+        return 1;
+    }
+
+    std::ostringstream otuCountString;
+    otuCountString << otuCount;
+    const int otuLabelWidth = otuCountString.str().size();
+
+    sharedFile << "label\tGroup\tnumOtus";
+    for (int j = 0; j < otuCount; j++) {
+        sharedFile << "\tOtu" << std::setw(otuLabelWidth) << std::setfill('0') << j + 1;
+    }
+    sharedFile << std::setfill(' ') << "\n";
+
+    for (int i = 0; i < sampleCount; i++) {
+        const int k = i % classCount;
+        std::ostringstream group;
+        group << "class_" << k << "." << i;
+
+        designFile << group.str() << "\tclass_" << k << "\n";
+
+        sharedFile << options["label"] << "\t" << group.str() << "\t" << otuCount;
+        for (int j = 0; j < otuCount; j++) {
+            long long count = 0;
+            if ( presentDistribution(generator) ) {
+                const double mean = std::min(classOtuMean[k][j] * rateDistribution(generator), maximumMeanCount);
+                if ( mean > 0.0 ) {
+                    std::poisson_distribution<long long> countDistribution(mean);
+                    count = countDistribution(generator);
+                }
+            }
+            sharedFile << "\t" << count;
+        }
+        sharedFile << "\n";
+    }
+
+    std::cout << "wrote " << sampleCount << " samples with " << otuCount << " OTUs in "
+              << classCount << " classes to " << sharedFilePath << " and " << designFilePath << std::endl;
+
+    return 0;
+}